@@ -5,6 +5,7 @@
 // Abstruct :   Class definition for Enviro Sensor
 // Author   :   application_division@atit.jp
 // Update   :   2025/09/13  New Creation
+//          :   2026/10/19  省メモリ構成対応
 #include <Wire.h>
 
 namespace AMAGOI {
@@ -23,20 +24,16 @@ private:
         REG_ADDR_CTRLCORR3          = 0xE1, // 補正データ(3)先頭アドレス
         REG_ADDR_OBSERV             = 0xF7  // 観測データ先頭アドレス
     };
-    const int       I2C_ADDR        = 0x76; // I2Cアドレス(規定値)
-    const uint8_t   OVER_SAMPLING   = 0x01; // オーバーサンプリング:×1(規定値)
-    const uint8_t   MODE            = 0x03; // モード:ノーマル(規定値)
-    const uint8_t   SPI3W           = 0x00; // 3線式SPI:未使用(固定値)
-    const uint8_t   FILTER          = 0x00; // フィルタ:OFF(規定値)
-    const uint8_t   T_STANDBY       = 0x05; // スタンバイ時間:1000(ms)
+    static constexpr int     I2C_ADDR       = 0x76; // I2Cアドレス(規定値)
+    static constexpr uint8_t OVER_SAMPLING  = 0x01; // オーバーサンプリング:×1(規定値)
+    static constexpr uint8_t MODE           = 0x03; // モード:ノーマル(規定値)
+    static constexpr uint8_t SPI3W          = 0x00; // 3線式SPI:未使用(固定値)
+    static constexpr uint8_t FILTER         = 0x00; // フィルタ:OFF(規定値)
+    static constexpr uint8_t T_STANDBY      = 0x05; // スタンバイ時間:1000(ms)
 public:
     // Definition of variable
 private:
     TwoWire*        myWire;                 // I2C通信クラスインスタンスへの参照
-    int             i2cAddr;                // I2Cアドレス
-    double          measureTemp;            // 観測値(気温)
-    double          measurePress;           // 観測値(気圧)
-    double          measureHum;             // 観測値(湿度)
     signed long int t_fine;                 // 補正用気温
 
     uint16_t        dig_T1;                 // 補正パラメータ1(気温)
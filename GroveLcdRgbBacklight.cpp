@@ -3,6 +3,7 @@
 // Abstruct :   Method for GroveLcdRgbBacklight class
 // Author   :   application_division@atit.jp
 // Update   :   2025/09/16  New Creation
+//          :   2026/10/19  省メモリ構成対応(ヒープ確保の廃止)
 #include <Arduino.h>
 #include "GroveLcdRgbBacklight.hpp"
 
@@ -13,8 +14,7 @@ using namespace AMAGOI;
 // Argument :   n/a
 GroveLcdRgbBacklight::GroveLcdRgbBacklight( TwoWire* wire ) {
   // LCDモニタ初期化
-  this->lcd = new rgb_lcd();
-  this->lcd->begin( (uint8_t)16, (uint8_t)2, (uint8_t)LCD_5x8DOTS, *wire );
+  this->lcd.begin( (uint8_t)16, (uint8_t)2, (uint8_t)LCD_5x8DOTS, *wire );
 }
 
 //
@@ -23,7 +23,7 @@ GroveLcdRgbBacklight::GroveLcdRgbBacklight( TwoWire* wire ) {
 // Argument :   n/a
 // Return   :   n/a
 void GroveLcdRgbBacklight::clearLcd() {
-    this->lcd->clear();
+    this->lcd.clear();
 }
 
 //
@@ -69,10 +69,10 @@ void GroveLcdRgbBacklight::writeLine( char* text ) {
 void GroveLcdRgbBacklight::writeLine( char* firstLine, char* secondLine ) {
   // 画面表示
   this->clearLcd();
-  this->lcd->setCursor( 0, 0 );
-  this->lcd->print( firstLine );
-  this->lcd->setCursor( 0, 1 );
-  this->lcd->print( secondLine );
+  this->lcd.setCursor( 0, 0 );
+  this->lcd.print( firstLine );
+  this->lcd.setCursor( 0, 1 );
+  this->lcd.print( secondLine );
 
   return;
 }
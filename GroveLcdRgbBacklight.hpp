@@ -5,6 +5,7 @@
 // Abstruct :   Class definition for Grove Lcd
 // Author   :   application_division@atit.jp
 // Update   :   2025/09/16  New Creation
+//          :   2026/10/19  省メモリ構成対応(ヒープ確保の廃止)
 #include <Wire.h>
 #include "rgb_lcd.h"
 
@@ -15,7 +16,7 @@ namespace AMAGOI {
 class GroveLcdRgbBacklight {
     // Definition of variable
 private:
-  rgb_lcd*    lcd;                  // lcdクラスインスタンス
+  rgb_lcd     lcd;                  // lcdクラスインスタンス
     // Definition of method
 private:
   void writeLine( char*, char* );   // method:LCD画面表示
@@ -3,9 +3,12 @@
 // Abstruct :   Method for InferenceEngine class
 // Author   :   application_division@atit.jp
 // Update   :   2025/09/20	New Creation
+//          :   2026/10/19  省メモリ構成対応
+//          :   2026/10/19  多期間傾向分析の追加
 #include <stdlib.h>
 #include <time.h>
 #include "InferenceEngine.hpp"
+#include "TrendAnalyzer.hpp"
 
 using namespace AMAGOI;
 //
@@ -18,11 +21,12 @@ InferenceEngine::InferenceEngine( double Q, double R )
 	, P( 1.0 )
 	, Q( Q )
 	, R( R )
-	, estVal{ 0.0 }
+	, estVal{ 0 }
 	, observCnt( 0 )
 	, estValCnt( 0 )
 	, inclination( 0.0 )
 	, inferredValue( 0.0 )
+	, trend( NULL )
 {
 	srand((unsigned int)time( NULL ));
 }
@@ -52,7 +56,7 @@ bool InferenceEngine::updateObservations( double x ) {
 	if( this->observCnt == 1 && this->estValCnt == 0 ) {
 		// 観測値を記憶(初回)
 		this->estValCnt++;
-		this->estVal[this->estValCnt - 1] = x;
+		this->estVal[this->estValCnt - 1] = toHistory( x );
 		isEstimation = false;
 	} else if( this->observCnt > EST_REC_CNT ) {
 		// 観測値を記憶
@@ -63,13 +67,18 @@ bool InferenceEngine::updateObservations( double x ) {
 		if( this->estValCnt < OBS_REC_CNT_MAX ) {
 			this->estValCnt++;
 		}
-		this->estVal[this->estValCnt - 1] = x;
+		this->estVal[this->estValCnt - 1] = toHistory( x );
 		
 		// 推定値を算出
 		calcInferredValue( xhat, this->estValCnt );
 		
 		// 最小二乗法にて傾きを算出
 		updatePrediction( this->estVal, this->estValCnt + EST_REC_CNT_MAX );
+
+		// 多期間の傾向を算出(フィルタ後の推定値を記録)
+		if( this->trend != NULL ) {
+			this->trend->addSample( xhat );
+		}
 		
 		// 推論フラグon
 		isEstimation = true;
@@ -98,7 +107,7 @@ void InferenceEngine::calcInferredValue( double xhat, int dataHead ) {
 		calcPredictedValue( &xhat, yhat, &Ghat, &Phat );
 		if( i % 60 == 0 ) {
 			// 記憶域に格納
-			this->estVal[dataHead] = xhat;
+			this->estVal[dataHead] = toHistory( xhat );
 			dataHead++;
 		}
 	}
@@ -133,10 +142,10 @@ void InferenceEngine::calcPredictedValue( double *xhat, double y, double *G, dou
 //
 // Method   :   updatePrediction
 // Abstruct :   最小二乗法を用いて傾きを算出する
-// Argument :   double y   : [I]観測及び推定値の記録配列
-//			:	int    cnt : [I]データ個数
+// Argument :   const HistoryValue* y   : [I]観測及び推定値の記録配列
+//			:	int                 cnt : [I]データ個数
 // Return   :   n/a
-void InferenceEngine::updatePrediction( double* y, int cnt ) {
+void InferenceEngine::updatePrediction( const HistoryValue* y, int cnt ) {
     double sum_xx = 0.0;
     double sum_xy = 0.0;
     double sum_x  = 0.0;
@@ -146,9 +155,9 @@ void InferenceEngine::updatePrediction( double* y, int cnt ) {
 	// note : 横軸は時間(秒単位)
 	for( int i = 0; i < cnt; i++) {
 		sum_xx += ( ((double)OBS_INTERVAL/1000.0) * (double)i ) * ( ((double)OBS_INTERVAL/1000.0) * (double)i );
-		sum_xy += ( ((double)OBS_INTERVAL/1000.0) * (double)i ) * y[i];
+		sum_xy += ( ((double)OBS_INTERVAL/1000.0) * (double)i ) * fromHistory( y[i] );
 		sum_x  += ( ((double)OBS_INTERVAL/1000.0) * (double)i );
-		sum_y  += y[i];
+		sum_y  += fromHistory( y[i] );
     }
     this->inclination = ( cnt * sum_xy - sum_x * sum_y ) / ( cnt * sum_xx - sum_x * sum_x );
 
@@ -158,14 +167,14 @@ void InferenceEngine::updatePrediction( double* y, int cnt ) {
 //
 // Method   :   arraySlide
 // Abstruct :   配列データをずらす
-// Argument :   double* array : [I]処理対象配列
+// Argument :   HistoryValue* array : [I]処理対象配列
 // Return   :   n/a
-void InferenceEngine::arraySlide( double* array ) {
+void InferenceEngine::arraySlide( HistoryValue* array ) {
 	array[0] = array[1];
 	for( int i = 1; i <= ( OBS_REC_CNT_MAX - 1 ) - 1; i++ ) {
 		array[i] = array[i + 1];
 	}
-	array[12] = 0.0;
+	array[12] = 0;
 	return;
 }
 
@@ -179,6 +188,35 @@ double InferenceEngine::addNoise2Observ( double x ) {
 	return x += rd;
 }
 
+//
+// Method   :   toHistory
+// Abstruct :   実値を記憶域の格納形式に変換する
+// Argument :   double x : [I]実値
+// Return   :   HistoryValue
+//				記憶域に格納する値
+//				※省メモリ構成では encodeValue による16bit整数(範囲外は飽和)
+HistoryValue InferenceEngine::toHistory( double x ) {
+#ifdef AMAGOI_LOW_MEMORY
+	return (HistoryValue)encodeValue( x, VALUE_INT16_MIN, VALUE_INT16_MAX );
+#else
+	return x;
+#endif
+}
+
+//
+// Method   :   fromHistory
+// Abstruct :   記憶域の格納値を実値に変換する
+// Argument :   HistoryValue v : [I]記憶域の格納値
+// Return   :   double
+//				実値
+double InferenceEngine::fromHistory( HistoryValue v ) {
+#ifdef AMAGOI_LOW_MEMORY
+	return decodeValue( (double)v );
+#else
+	return v;
+#endif
+}
+
 //
 // Method   :   getInferredValue
 // Abstruct :   ゲッタ(推定値)
@@ -197,4 +235,19 @@ double InferenceEngine::getInferredValue() {
 //				メンバ inclination の値
 double InferenceEngine::getInclination() {
 	return this->inclination;
+}
+
+//
+// Method   :   setTrendAnalyzer
+// Abstruct :   セッタ(多期間傾向分析)
+//				設定した場合、推定処理毎にフィルタ後の推定値を記録する
+//				サンプル間隔は推定処理の実周期(EST_PERIOD)に設定する
+// Argument :   TrendAnalyzer* analyzer : [I]多期間傾向分析クラスインスタンスへの参照(NULLで解除)
+// Return   :   n/a
+void InferenceEngine::setTrendAnalyzer( TrendAnalyzer* analyzer ) {
+	this->trend = analyzer;
+	if( this->trend != NULL ) {
+		this->trend->setInterval( EST_PERIOD );
+	}
+	return;
 }
\ No newline at end of file
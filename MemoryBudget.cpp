@@ -0,0 +1,81 @@
+//
+// Filename :   MemoryBudget.cpp
+// Abstruct :   Build time SRAM report and budget check
+// Author   :   application_division@atit.jp
+// Update   :   2026/10/19  New Creation
+#include "MemoryConfig.hpp"
+#include "EnviroSensor.hpp"
+#include "GroveLcdRgbBacklight.hpp"
+#include "InferenceEngine.hpp"
+#include "TrendAnalyzer.hpp"
+
+namespace AMAGOI {
+//
+// Class    :   MemoryBudget
+// Abstruct :   SRAM使用量の上限チェック
+//              上限超過時はコンパイルエラーとなり、エラー出力の
+//              "MemoryBudget<SIZE, BUDGET>" に使用量と上限(byte)が表示される
+//              ※警告レベルの設定に依存しない
+template< unsigned int SIZE, unsigned int BUDGET >
+struct MemoryBudget {
+    static_assert( SIZE <= BUDGET, "AMAGOI SRAM budget exceeded : MemoryBudget<SIZE, BUDGET>" );
+    static constexpr bool fits = ( SIZE <= BUDGET );
+};
+
+// クラス毎のSRAM使用量
+constexpr unsigned int SRAM_INFERENCE = sizeof( InferenceEngine );
+constexpr unsigned int SRAM_TREND     = sizeof( TrendAnalyzer );
+constexpr unsigned int SRAM_SENSOR    = sizeof( EnviroSensor );
+constexpr unsigned int SRAM_LCD       = sizeof( GroveLcdRgbBacklight );
+constexpr unsigned int SRAM_TOTAL     = SRAM_INFERENCE + SRAM_TREND + SRAM_SENSOR + SRAM_LCD;   // ※TrendAnalyzer 使用時
+
+// 上限チェック
+static_assert( MemoryBudget< SRAM_INFERENCE, AMAGOI_SRAM_BUDGET_INFERENCE >::fits,
+               "InferenceEngine exceeds AMAGOI_SRAM_BUDGET_INFERENCE" );
+static_assert( MemoryBudget< SRAM_TREND,     AMAGOI_SRAM_BUDGET_TREND >::fits,
+               "TrendAnalyzer exceeds AMAGOI_SRAM_BUDGET_TREND" );
+static_assert( MemoryBudget< SRAM_SENSOR,    AMAGOI_SRAM_BUDGET_SENSOR >::fits,
+               "EnviroSensor exceeds AMAGOI_SRAM_BUDGET_SENSOR" );
+static_assert( MemoryBudget< SRAM_LCD,       AMAGOI_SRAM_BUDGET_LCD >::fits,
+               "GroveLcdRgbBacklight exceeds AMAGOI_SRAM_BUDGET_LCD" );
+static_assert( MemoryBudget< SRAM_TOTAL,     AMAGOI_SRAM_BUDGET_TOTAL >::fits,
+               "AMAGOI classes exceed AMAGOI_SRAM_BUDGET_TOTAL" );
+
+//
+// Method   :   memoryReport
+// Abstruct :   クラス毎のSRAM使用量と上限をELFの絶対シンボルとして出力する
+//              amagoi_sram_<クラス名> / amagoi_budget_<クラス名> の値がbyte数となる
+//              ※シンボルのみでSRAM/Flashは消費しない(本関数は未参照のためリンク時に削除される)
+//              ※警告レベルの設定に依存しない
+// Argument :   n/a
+// Return   :   n/a
+void memoryReport() {
+    __asm__ __volatile__ (
+        ".global amagoi_sram_InferenceEngine\n\t"
+        ".set    amagoi_sram_InferenceEngine, %c0\n\t"
+        ".global amagoi_sram_TrendAnalyzer\n\t"
+        ".set    amagoi_sram_TrendAnalyzer, %c1\n\t"
+        ".global amagoi_sram_EnviroSensor\n\t"
+        ".set    amagoi_sram_EnviroSensor, %c2\n\t"
+        ".global amagoi_sram_GroveLcdRgbBacklight\n\t"
+        ".set    amagoi_sram_GroveLcdRgbBacklight, %c3\n\t"
+        ".global amagoi_sram_Total\n\t"
+        ".set    amagoi_sram_Total, %c4\n\t"
+        ".global amagoi_budget_InferenceEngine\n\t"
+        ".set    amagoi_budget_InferenceEngine, %c5\n\t"
+        ".global amagoi_budget_TrendAnalyzer\n\t"
+        ".set    amagoi_budget_TrendAnalyzer, %c6\n\t"
+        ".global amagoi_budget_EnviroSensor\n\t"
+        ".set    amagoi_budget_EnviroSensor, %c7\n\t"
+        ".global amagoi_budget_GroveLcdRgbBacklight\n\t"
+        ".set    amagoi_budget_GroveLcdRgbBacklight, %c8\n\t"
+        ".global amagoi_budget_Total\n\t"
+        ".set    amagoi_budget_Total, %c9\n\t"
+        :
+        : "n"( SRAM_INFERENCE ), "n"( SRAM_TREND ), "n"( SRAM_SENSOR ), "n"( SRAM_LCD ), "n"( SRAM_TOTAL ),
+          "n"( AMAGOI_SRAM_BUDGET_INFERENCE ), "n"( AMAGOI_SRAM_BUDGET_TREND ), "n"( AMAGOI_SRAM_BUDGET_SENSOR ),
+          "n"( AMAGOI_SRAM_BUDGET_LCD ), "n"( AMAGOI_SRAM_BUDGET_TOTAL )
+    );
+    return;
+}
+}
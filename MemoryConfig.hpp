@@ -0,0 +1,153 @@
+#ifndef MEMORY_CONFIG_H
+#define MEMORY_CONFIG_H
+//
+// Filename :   MemoryConfig.hpp
+// Abstruct :   Memory configuration and SRAM budget definition
+// Author   :   application_division@atit.jp
+// Update   :   2026/10/19  New Creation
+#include <stdint.h>
+#include <math.h>
+
+//
+// 省メモリ構成
+// ATmega328P(SRAM 2KB)向けビルドでは自動的に有効化する
+// 倍精度で動作させたい場合は AMAGOI_FULL_PRECISION を定義すること
+#if defined( __AVR_ATmega328P__ ) && !defined( AMAGOI_FULL_PRECISION ) && !defined( AMAGOI_LOW_MEMORY )
+#define AMAGOI_LOW_MEMORY
+#endif
+
+//
+// 整数記録時の格納倍率および基準値
+// 観測値および推定値記憶域(省メモリ構成)と傾向分析で共通に使用し、
+// 基準値との差分に格納倍率を掛けた整数で記録する
+// ※既定値(気圧)の場合 分解能0.01hPa / 16bit整数での範囲 685.33～1340.67hPa
+#ifndef AMAGOI_VALUE_SCALE
+#define AMAGOI_VALUE_SCALE              100
+#endif
+#ifndef AMAGOI_VALUE_REFERENCE
+#define AMAGOI_VALUE_REFERENCE          1013.0
+#endif
+
+//
+// 傾向分析の記憶サンプル数
+// サンプルは推定処理毎(約5分毎)に1件記録する
+// ※N時間分の区間には N×12+1 サンプルが必要(両端を含む)
+//   省メモリ構成の既定値は3時間分(37)、それ以外は7日分(2017)
+#ifndef AMAGOI_TREND_CAPACITY
+#ifdef AMAGOI_LOW_MEMORY
+#define AMAGOI_TREND_CAPACITY           37
+#else
+#define AMAGOI_TREND_CAPACITY           2017
+#endif
+#endif
+
+//
+// 傾向分析の傾向期間(分)
+// 短期/中期/長期の3期間を算出する(長期は気圧傾向の判定期間3時間を既定とする)
+#ifndef AMAGOI_TREND_HORIZON_SHORT
+#define AMAGOI_TREND_HORIZON_SHORT      15
+#endif
+#ifndef AMAGOI_TREND_HORIZON_MIDDLE
+#define AMAGOI_TREND_HORIZON_MIDDLE     60
+#endif
+#ifndef AMAGOI_TREND_HORIZON_LONG
+#define AMAGOI_TREND_HORIZON_LONG       180
+#endif
+
+//
+// クラス毎のSRAM使用量上限(byte)
+// 上限を超えた場合はビルドエラーとなる
+// ※TrendAnalyzer の上限は AMAGOI_TREND_CAPACITY に連動させない(既定値の3時間分/7日分を前提とする)
+#ifdef AMAGOI_LOW_MEMORY
+#ifndef AMAGOI_SRAM_BUDGET_TREND
+#define AMAGOI_SRAM_BUDGET_TREND        352
+#endif
+#ifndef AMAGOI_SRAM_BUDGET_INFERENCE
+#define AMAGOI_SRAM_BUDGET_INFERENCE    96
+#endif
+#ifndef AMAGOI_SRAM_BUDGET_SENSOR
+#define AMAGOI_SRAM_BUDGET_SENSOR       56
+#endif
+#ifndef AMAGOI_SRAM_BUDGET_LCD
+#define AMAGOI_SRAM_BUDGET_LCD          32
+#endif
+#ifndef AMAGOI_SRAM_BUDGET_TOTAL
+#define AMAGOI_SRAM_BUDGET_TOTAL        512
+#endif
+#else
+#ifndef AMAGOI_SRAM_BUDGET_TREND
+#define AMAGOI_SRAM_BUDGET_TREND        32768
+#endif
+#ifndef AMAGOI_SRAM_BUDGET_INFERENCE
+#define AMAGOI_SRAM_BUDGET_INFERENCE    512
+#endif
+#ifndef AMAGOI_SRAM_BUDGET_SENSOR
+#define AMAGOI_SRAM_BUDGET_SENSOR       128
+#endif
+#ifndef AMAGOI_SRAM_BUDGET_LCD
+#define AMAGOI_SRAM_BUDGET_LCD          128
+#endif
+#ifndef AMAGOI_SRAM_BUDGET_TOTAL
+#define AMAGOI_SRAM_BUDGET_TOTAL        33536
+#endif
+#endif
+
+namespace AMAGOI {
+// 整数記録時の飽和範囲
+constexpr int32_t VALUE_INT16_MIN = -32767L - 1;
+constexpr int32_t VALUE_INT16_MAX = 32767L;
+constexpr int32_t VALUE_INT32_MIN = -2147483647L - 1;
+constexpr int32_t VALUE_INT32_MAX = 2147483647L;
+
+//
+// Function :   encodeValue
+// Abstruct :   実値を整数記録形式に変換する
+// Argument :   double  x      : [I]実値
+//          :   int32_t minVal : [I]飽和下限
+//          :   int32_t maxVal : [I]飽和上限
+// Return   :   int32_t
+//              AMAGOI_VALUE_REFERENCE との差分を AMAGOI_VALUE_SCALE 倍した整数(範囲外は飽和)
+inline int32_t encodeValue( double x, int32_t minVal, int32_t maxVal ) {
+    double scaled = floor( ( x - (double)AMAGOI_VALUE_REFERENCE ) * (double)AMAGOI_VALUE_SCALE + 0.5 );
+    if( scaled > (double)maxVal ) {
+        return maxVal;
+    } else if( scaled < (double)minVal ) {
+        return minVal;
+    }
+    return (int32_t)scaled;
+}
+
+//
+// Function :   decodeValue
+// Abstruct :   整数記録形式を実値に変換する
+// Argument :   double v : [I]整数記録値(区間平均等の非整数も可)
+// Return   :   double
+//              実値
+inline double decodeValue( double v ) {
+    return v / (double)AMAGOI_VALUE_SCALE + (double)AMAGOI_VALUE_REFERENCE;
+}
+
+//
+// Type     :   HistoryValue
+// Abstruct :   観測値および推定値記憶域の要素型
+#ifdef AMAGOI_LOW_MEMORY
+typedef int16_t HistoryValue;
+#else
+typedef double  HistoryValue;
+#endif
+
+//
+// Type     :   TrendSample / TrendAccum / TrendSigned
+// Abstruct :   傾向分析のサンプル型および累積和の型
+//              累積和は符号なし整数の剰余演算で保持し、区間和を差分で厳密に求める
+#ifdef AMAGOI_LOW_MEMORY
+typedef int16_t  TrendSample;
+typedef uint32_t TrendAccum;
+typedef int32_t  TrendSigned;
+#else
+typedef int32_t  TrendSample;
+typedef uint64_t TrendAccum;
+typedef int64_t  TrendSigned;
+#endif
+}
+#endif // #ifndef MEMORY_CONFIG_H
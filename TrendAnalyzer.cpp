@@ -0,0 +1,223 @@
+//
+// Filename :   TrendAnalyzer.cpp
+// Abstruct :   Method for TrendAnalyzer class
+// Author   :   application_division@atit.jp
+// Update   :   2026/10/19  New Creation
+#include "TrendAnalyzer.hpp"
+
+using namespace AMAGOI;
+//
+// Method   :   TrendAnalyzer
+// Abstruct :   コンストラクタ
+// Argument :   uint32_t interval : [I]サンプル記録間隔(ミリ秒)
+TrendAnalyzer::TrendAnalyzer( uint32_t interval )
+	: sumY{ 0 }
+	, sumTY{ 0 }
+	, sampleCnt( 0 )
+	, sampleSec( 0.0 )
+	, horizonCnt{ 0 }
+	, slope{ 0.0 }
+	, intercept{ 0.0 }
+	, tendencyVal{ 0 }
+	, valid{ false }
+{
+	setInterval( interval );
+}
+
+//
+// Method   :   setInterval
+// Abstruct :   サンプル記録間隔を設定して傾向期間毎のサンプル数を算出する
+// Argument :   uint32_t interval : [I]サンプル記録間隔(ミリ秒)
+// Return   :   n/a
+void TrendAnalyzer::setInterval( uint32_t interval ) {
+	// 傾向期間(分)
+	const uint16_t horizonMin[HORIZON_NUM] = {
+		AMAGOI_TREND_HORIZON_SHORT, AMAGOI_TREND_HORIZON_MIDDLE, AMAGOI_TREND_HORIZON_LONG
+	};
+
+	this->sampleSec = (double)interval / 1000.0;
+
+	// 傾向期間毎のサンプル数を算出(記憶域の範囲内に制限)
+	// note : 期間全体を覆うため区間の両端を含めて 間隔数+1 サンプルとする
+	for( int i = 0; i < HORIZON_NUM; i++ ) {
+		uint32_t cnt = ( (uint32_t)horizonMin[i] * 60UL * 1000UL ) / interval + 1;
+		if( cnt > AMAGOI_TREND_CAPACITY ) {
+			cnt = AMAGOI_TREND_CAPACITY;
+		}
+		this->horizonCnt[i] = (uint16_t)cnt;
+	}
+
+	return;
+}
+
+//
+// Method   :   addSample
+// Abstruct :   サンプルを記録して全傾向期間の傾向を更新する
+// Argument :   double y : [I]記録する値
+// Return   :   n/a
+void TrendAnalyzer::addSample( double y ) {
+	// 累積和を更新
+	// note : 剰余演算のため桁あふれしても区間和は厳密に求まる
+	TrendAccum v    = (TrendAccum)(TrendSigned)toSample( y );
+	uint16_t   cur  = (uint16_t)( this->sampleCnt % RING_MAX );
+	uint16_t   next = (uint16_t)( ( this->sampleCnt + 1 ) % RING_MAX );
+	this->sumY[next]  = this->sumY[cur]  + v;
+	this->sumTY[next] = this->sumTY[cur] + (TrendAccum)this->sampleCnt * v;
+	this->sampleCnt++;
+
+	// 全傾向期間の傾き/切片/気圧傾向を算出
+	for( int i = 0; i < HORIZON_NUM; i++ ) {
+		this->valid[i] = fitWindow( 0, this->horizonCnt[i], &(this->slope[i]), &(this->intercept[i]) );
+		if( this->valid[i] ) {
+			this->tendencyVal[i] = classifyTendency( this->slope[i] );
+		} else {
+			this->tendencyVal[i] = TENDENCY_STEADY;
+		}
+	}
+
+	return;
+}
+
+//
+// Method   :   fitWindow
+// Abstruct :   任意区間の最小二乗傾き/切片を算出する
+// Argument :   uint16_t offset     : [I]区間終端(最新サンプルから遡るサンプル数)
+//			:	uint16_t cnt        : [I]区間のサンプル数
+//			:	double*  slopeOut   : [O]傾き(単位/秒)
+//			:	double*  interOut   : [O]切片(区間先頭時点の値)
+// Return   :   bool
+//				区間のサンプルが揃っており算出を実施した場合 true
+bool TrendAnalyzer::fitWindow( uint16_t offset, uint16_t cnt, double* slopeOut, double* interOut ) {
+	// 区間の妥当性確認
+	if( cnt < 2 || (uint32_t)offset + cnt > getSampleCount() ) {
+		return false;
+	}
+
+	// 区間和を累積和の差分から算出
+	// note : 横軸は区間先頭を0とするサンプル番号
+	uint32_t   tail = this->sampleCnt - offset;
+	uint32_t   head = tail - cnt;
+	TrendAccum sy   = this->sumY[tail % RING_MAX] - this->sumY[head % RING_MAX];
+	TrendAccum sty  = this->sumTY[tail % RING_MAX] - this->sumTY[head % RING_MAX] - (TrendAccum)head * sy;
+
+	// 傾きを算出
+	// note : n*Σxy - Σx*Σy は整数のまま算出し桁落ちを避ける
+	TrendAccum n     = (TrendAccum)cnt;
+	TrendAccum sx    = n * ( n - 1 ) / 2;
+	TrendSigned numer = (TrendSigned)( n * sty - sx * sy );
+	double     denom = (double)cnt * (double)cnt * ( (double)cnt * (double)cnt - 1.0 ) / 12.0;
+	double     slopeSample = ( (double)numer / denom ) / (double)AMAGOI_VALUE_SCALE;
+	double     meanY = decodeValue( (double)(TrendSigned)sy / (double)cnt );
+
+	// 横軸を秒単位に換算して返却
+	*slopeOut = slopeSample / this->sampleSec;
+	*interOut = meanY - slopeSample * ( (double)( cnt - 1 ) / 2.0 );
+
+	return true;
+}
+
+//
+// Method   :   toSample
+// Abstruct :   実値を累積和の格納形式に変換する
+// Argument :   double y : [I]実値
+// Return   :   TrendSample
+//				encodeValue による整数(範囲外は飽和)
+TrendSample TrendAnalyzer::toSample( double y ) {
+#ifdef AMAGOI_LOW_MEMORY
+	return (TrendSample)encodeValue( y, VALUE_INT16_MIN, VALUE_INT16_MAX );
+#else
+	return (TrendSample)encodeValue( y, VALUE_INT32_MIN, VALUE_INT32_MAX );
+#endif
+}
+
+//
+// Method   :   classifyTendency
+// Abstruct :   傾きから気圧傾向を分類する
+//				3時間あたりの変化量(hPa)に換算して判定する
+// Argument :   double inc : [I]傾き(hPa/秒)
+// Return   :   int8_t
+//				気圧傾向(tendency)
+int8_t TrendAnalyzer::classifyTendency( double inc ) {
+	double change = inc * (double)TENDENCY_SEC;
+	double level  = fabs( change );
+	int8_t grade  = 0;
+
+	if( level < TENDENCY_STEADY_TH ) {
+		grade = 0;
+	} else if( level < TENDENCY_SLOWLY_TH ) {
+		grade = 1;
+	} else if( level < TENDENCY_NORMAL_TH ) {
+		grade = 2;
+	} else if( level <= TENDENCY_QUICKLY_TH ) {
+		grade = 3;
+	} else {
+		grade = 4;
+	}
+
+	return ( change < 0.0 ) ? -grade : grade;
+}
+
+//
+// Method   :   getSampleCount
+// Abstruct :   ゲッタ(参照可能なサンプル数)
+// Argument :   n/a
+// Return   :   uint16_t
+//				記憶域に保持しているサンプル数
+uint16_t TrendAnalyzer::getSampleCount() {
+	if( this->sampleCnt < AMAGOI_TREND_CAPACITY ) {
+		return (uint16_t)this->sampleCnt;
+	}
+	return AMAGOI_TREND_CAPACITY;
+}
+
+//
+// Method   :   isValid
+// Abstruct :   ゲッタ(算出済みフラグ)
+// Argument :   horizon h : [I]傾向期間
+// Return   :   bool
+//				指定期間の傾向を算出済みの場合 true
+bool TrendAnalyzer::isValid( horizon h ) {
+	if( h < 0 || h >= HORIZON_NUM ) {
+		return false;
+	}
+	return this->valid[h];
+}
+
+//
+// Method   :   getSlope
+// Abstruct :   ゲッタ(傾き)
+// Argument :   horizon h : [I]傾向期間
+// Return   :   double
+//				指定期間の傾き(単位/秒)
+double TrendAnalyzer::getSlope( horizon h ) {
+	if( h < 0 || h >= HORIZON_NUM ) {
+		return 0.0;
+	}
+	return this->slope[h];
+}
+
+//
+// Method   :   getIntercept
+// Abstruct :   ゲッタ(切片)
+// Argument :   horizon h : [I]傾向期間
+// Return   :   double
+//				指定期間の切片(区間先頭時点の値)
+double TrendAnalyzer::getIntercept( horizon h ) {
+	if( h < 0 || h >= HORIZON_NUM ) {
+		return 0.0;
+	}
+	return this->intercept[h];
+}
+
+//
+// Method   :   getTendency
+// Abstruct :   ゲッタ(気圧傾向)
+// Argument :   horizon h : [I]傾向期間
+// Return   :   tendency
+//				指定期間の気圧傾向
+TrendAnalyzer::tendency TrendAnalyzer::getTendency( horizon h ) {
+	if( h < 0 || h >= HORIZON_NUM ) {
+		return TENDENCY_STEADY;
+	}
+	return (tendency)this->tendencyVal[h];
+}
@@ -0,0 +1,73 @@
+#ifndef TREND_ANALYZER_H
+#define TREND_ANALYZER_H
+//
+// Filename :   TrendAnalyzer.hpp
+// Abstruct :   Class definition for multi-horizon trend analyzer
+// Author   :   application_division@atit.jp
+// Update   :   2026/10/19  New Creation
+#include <math.h>
+#include "MemoryConfig.hpp"
+
+namespace AMAGOI {
+//
+// Class    :   TrendAnalyzer
+// Abstruct :   Class definition for multi-horizon trend analyzer
+//              累積和を用いて任意区間の最小二乗傾き/切片を定数時間で算出する
+class TrendAnalyzer {
+    // Definition of constant
+public:
+    enum horizon {
+        HORIZON_SHORT               = 0,    // 短期傾向(既定値15分)
+        HORIZON_MIDDLE,                     // 中期傾向(既定値1時間)
+        HORIZON_LONG,                       // 長期傾向(既定値3時間)
+        HORIZON_NUM                         // 傾向期間数
+    };
+    enum tendency {
+        TENDENCY_FALLING_VERY_RAPIDLY = -4, // 非常に急速に下降
+        TENDENCY_FALLING_QUICKLY      = -3, // 急速に下降
+        TENDENCY_FALLING              = -2, // 下降
+        TENDENCY_FALLING_SLOWLY       = -1, // 緩やかに下降
+        TENDENCY_STEADY               =  0, // 変化なし
+        TENDENCY_RISING_SLOWLY        =  1, // 緩やかに上昇
+        TENDENCY_RISING               =  2, // 上昇
+        TENDENCY_RISING_QUICKLY       =  3, // 急速に上昇
+        TENDENCY_RISING_VERY_RAPIDLY  =  4  // 非常に急速に上昇
+    };
+private:
+    static constexpr uint16_t RING_MAX          = ( AMAGOI_TREND_CAPACITY + 1 );    // 累積和記憶域データ長
+    static constexpr uint32_t TENDENCY_SEC      = ( 3UL * 60 * 60 );                // 気圧傾向の判定期間(秒)
+    static constexpr double   TENDENCY_STEADY_TH  = 0.1;                            // 変化なし判定閾値(hPa/3h)
+    static constexpr double   TENDENCY_SLOWLY_TH  = 1.6;                            // 緩やか判定閾値(hPa/3h)
+    static constexpr double   TENDENCY_NORMAL_TH  = 3.6;                            // 通常判定閾値(hPa/3h)
+    static constexpr double   TENDENCY_QUICKLY_TH = 6.0;                            // 急速判定閾値(hPa/3h)
+    // Definition of variable
+private:
+    TrendAccum  sumY[RING_MAX];             // 累積和(観測値)
+    TrendAccum  sumTY[RING_MAX];            // 累積和(時刻×観測値)
+    uint32_t    sampleCnt;                  // 記録済みサンプル総数
+    double      sampleSec;                  // サンプル間隔(秒)
+    uint16_t    horizonCnt[HORIZON_NUM];    // 傾向期間毎のサンプル数
+    double      slope[HORIZON_NUM];         // 傾向期間毎の傾き(単位/秒)
+    double      intercept[HORIZON_NUM];     // 傾向期間毎の切片
+    int8_t      tendencyVal[HORIZON_NUM];   // 傾向期間毎の気圧傾向
+    bool        valid[HORIZON_NUM];         // 傾向期間毎の算出済みフラグ
+    // Definition of method
+private:
+    static TrendSample toSample( double );
+    static int8_t classifyTendency( double );
+public:
+    TrendAnalyzer( uint32_t );
+    void setInterval( uint32_t );
+    void addSample( double );
+    // 区間終端+サンプル数が getSampleCount() を超える場合、またはサンプル数が2未満の場合は
+    // 算出せず false を返す(出力引数は変更しない)
+    bool fitWindow( uint16_t, uint16_t, double*, double* );
+    uint16_t getSampleCount();
+    // 範囲外の傾向期間を指定した場合は false / 0.0 / TENDENCY_STEADY を返す
+    bool isValid( horizon );
+    double getSlope( horizon );
+    double getIntercept( horizon );
+    tendency getTendency( horizon );
+};
+}
+#endif // #ifndef TREND_ANALYZER_H